@@ -0,0 +1,241 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Bitboard.hpp"
+#include "Piece.hpp"
+
+/**
+ * Precomputed attack tables
+ *  - Built at compile time (constexpr) over the square mapping from
+ *    documents/board_setup.md: h1 = 0, a1 = 7, h8 = 56, a8 = 63
+ *  - Moving one file towards h (east) is -1, one rank up (north) is +8
+ */
+namespace chess::core {
+
+/* ======================= BOARD MASKS ======================= */
+constexpr Bitboard FILE_H_BB = 0x0101010101010101ULL;
+constexpr Bitboard FILE_A_BB = 0x8080808080808080ULL;
+
+constexpr Bitboard RANK_1_BB = 0x00000000000000FFULL;
+constexpr Bitboard rankBB(int rank) { return RANK_1_BB << (8 * rank); }
+
+// Compass directions, value = square offset of one step
+enum class Direction : int {
+    North = 8,
+    South = -8,
+    East = -1,
+    West = 1,
+    NorthEast = 7,
+    NorthWest = 9,
+    SouthEast = -9,
+    SouthWest = -7,
+};
+
+constexpr int offset(Direction direction) {
+    return static_cast<int>(direction);
+}
+
+// Shift every bit one step in direction D, dropping bits leaving the board
+template <Direction D> constexpr Bitboard shift(Bitboard bb) {
+    if constexpr (D == Direction::North)
+        return bb << 8;
+    else if constexpr (D == Direction::South)
+        return bb >> 8;
+    else if constexpr (D == Direction::East)
+        return (bb & ~FILE_H_BB) >> 1;
+    else if constexpr (D == Direction::West)
+        return (bb & ~FILE_A_BB) << 1;
+    else if constexpr (D == Direction::NorthEast)
+        return (bb & ~FILE_H_BB) << 7;
+    else if constexpr (D == Direction::NorthWest)
+        return (bb & ~FILE_A_BB) << 9;
+    else if constexpr (D == Direction::SouthEast)
+        return (bb & ~FILE_H_BB) >> 9;
+    else
+        return (bb & ~FILE_A_BB) >> 7;
+}
+
+// Same as shift<D>, direction picked at runtime
+constexpr Bitboard shift(Bitboard bb, Direction direction) {
+    switch (direction) {
+    case Direction::North:
+        return shift<Direction::North>(bb);
+    case Direction::South:
+        return shift<Direction::South>(bb);
+    case Direction::East:
+        return shift<Direction::East>(bb);
+    case Direction::West:
+        return shift<Direction::West>(bb);
+    case Direction::NorthEast:
+        return shift<Direction::NorthEast>(bb);
+    case Direction::NorthWest:
+        return shift<Direction::NorthWest>(bb);
+    case Direction::SouthEast:
+        return shift<Direction::SouthEast>(bb);
+    default:
+        return shift<Direction::SouthWest>(bb);
+    }
+}
+
+/* ======================= TABLE BUILDERS ======================= */
+namespace detail {
+
+constexpr bool on_board(int rank, int file) {
+    return rank >= 0 && rank < 8 && file >= 0 && file < 8;
+}
+
+struct Step {
+    int rank;
+    int file;
+};
+
+// Rays in the order N, S, E, W, NE, NW, SE, SW
+constexpr Step RAY_STEPS[8] = {{1, 0},  {-1, 0}, {0, 1},  {0, -1},
+                               {1, 1},  {1, -1}, {-1, 1}, {-1, -1}};
+
+constexpr Bitboard step_attacks(int square, const Step *steps, int count) {
+    Bitboard attacks = 0ULL;
+    for (int i = 0; i < count; ++i) {
+        int rank = rankOf(square) + steps[i].rank;
+        int file = fileOf(square) + steps[i].file;
+        if (on_board(rank, file))
+            attacks |= squareBB(squareIndex(rank, file));
+    }
+    return attacks;
+}
+
+constexpr std::array<Bitboard, 64> make_knight_attacks() {
+    constexpr Step steps[] = {{2, 1}, {2, -1}, {-2, 1}, {-2, -1},
+                              {1, 2}, {1, -2}, {-1, 2}, {-1, -2}};
+    std::array<Bitboard, 64> table{};
+    for (int square = 0; square < 64; ++square)
+        table[square] = step_attacks(square, steps, 8);
+    return table;
+}
+
+constexpr std::array<Bitboard, 64> make_king_attacks() {
+    std::array<Bitboard, 64> table{};
+    for (int square = 0; square < 64; ++square)
+        table[square] = step_attacks(square, RAY_STEPS, 8);
+    return table;
+}
+
+constexpr std::array<std::array<Bitboard, 64>, 2> make_pawn_attacks() {
+    constexpr Step white[] = {{1, 1}, {1, -1}};
+    constexpr Step black[] = {{-1, 1}, {-1, -1}};
+    std::array<std::array<Bitboard, 64>, 2> table{};
+    for (int square = 0; square < 64; ++square) {
+        table[0][square] = step_attacks(square, white, 2);
+        table[1][square] = step_attacks(square, black, 2);
+    }
+    return table;
+}
+
+// Every square from square to the edge of the board in one direction
+constexpr std::array<std::array<Bitboard, 64>, 8> make_rays() {
+    std::array<std::array<Bitboard, 64>, 8> table{};
+    for (int dir = 0; dir < 8; ++dir) {
+        for (int square = 0; square < 64; ++square) {
+            int rank = rankOf(square) + RAY_STEPS[dir].rank;
+            int file = fileOf(square) + RAY_STEPS[dir].file;
+            while (on_board(rank, file)) {
+                table[dir][square] |= squareBB(squareIndex(rank, file));
+                rank += RAY_STEPS[dir].rank;
+                file += RAY_STEPS[dir].file;
+            }
+        }
+    }
+    return table;
+}
+
+} // namespace detail
+
+/* ======================= TABLES ======================= */
+inline constexpr std::array<Bitboard, 64> KNIGHT_ATTACKS =
+    detail::make_knight_attacks();
+inline constexpr std::array<Bitboard, 64> KING_ATTACKS =
+    detail::make_king_attacks();
+
+// Indexed [color][square]
+inline constexpr std::array<std::array<Bitboard, 64>, 2> PAWN_ATTACKS =
+    detail::make_pawn_attacks();
+
+// Indexed [ray][square], rays ordered N, S, E, W, NE, NW, SE, SW
+inline constexpr std::array<std::array<Bitboard, 64>, 8> RAYS =
+    detail::make_rays();
+
+namespace detail {
+
+/**
+ * Attacks along one ray, stopped at (and including) the first blocker
+ *  - Rays going up in square index (N, W, NE, NW) hit their nearest blocker
+ *    at the lowest set bit, the others at the highest set bit
+ */
+template <int Ray>
+constexpr Bitboard ray_attacks(int square, Bitboard occupied) {
+    constexpr bool increasing = Ray == 0 || Ray == 3 || Ray == 4 || Ray == 5;
+
+    Bitboard attacks = RAYS[Ray][square];
+    Bitboard blockers = attacks & occupied;
+    if (blockers) {
+        int blocker = increasing ? lsb(blockers) : msb(blockers);
+        attacks ^= RAYS[Ray][blocker];
+    }
+    return attacks;
+}
+
+} // namespace detail
+
+constexpr Bitboard bishopAttacks(int square, Bitboard occupied) {
+    return detail::ray_attacks<4>(square, occupied) |
+           detail::ray_attacks<5>(square, occupied) |
+           detail::ray_attacks<6>(square, occupied) |
+           detail::ray_attacks<7>(square, occupied);
+}
+
+constexpr Bitboard rookAttacks(int square, Bitboard occupied) {
+    return detail::ray_attacks<0>(square, occupied) |
+           detail::ray_attacks<1>(square, occupied) |
+           detail::ray_attacks<2>(square, occupied) |
+           detail::ray_attacks<3>(square, occupied);
+}
+
+constexpr Bitboard queenAttacks(int square, Bitboard occupied) {
+    return bishopAttacks(square, occupied) | rookAttacks(square, occupied);
+}
+
+constexpr Bitboard pawnAttacks(Color color, int square) {
+    return PAWN_ATTACKS[static_cast<int>(color)][square];
+}
+
+namespace detail {
+
+// Squares strictly between two squares sharing a rank, file or diagonal
+constexpr std::array<std::array<Bitboard, 64>, 64> make_between() {
+    std::array<std::array<Bitboard, 64>, 64> table{};
+    for (int from = 0; from < 64; ++from) {
+        for (int dir = 0; dir < 8; ++dir) {
+            Bitboard path = 0ULL;
+            int rank = rankOf(from) + RAY_STEPS[dir].rank;
+            int file = fileOf(from) + RAY_STEPS[dir].file;
+            while (on_board(rank, file)) {
+                int to = squareIndex(rank, file);
+                table[from][to] = path;
+                path |= squareBB(to);
+                rank += RAY_STEPS[dir].rank;
+                file += RAY_STEPS[dir].file;
+            }
+        }
+    }
+    return table;
+}
+
+} // namespace detail
+
+// Indexed [from][to], empty when squares are not aligned
+inline constexpr std::array<std::array<Bitboard, 64>, 64> BETWEEN_BB =
+    detail::make_between();
+
+} // namespace chess::core
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+/**
+ * Small bitboard helpers
+ *  - std::popcount / std::countr_zero compile to popcnt / tzcnt when the
+ *    target supports them
+ */
+namespace chess::core {
+
+using Bitboard = std::uint64_t;
+
+/* ======================= SQUARE MAPPING ======================= */
+// Refer to documents/board_setup.md: h1 = 0, a1 = 7, h8 = 56, a8 = 63
+// rank & file -> 0-7 (file 0 = a)
+constexpr int squareIndex(int rank, int file) { return rank * 8 + (7 - file); }
+constexpr int rankOf(int square) { return square / 8; }
+constexpr int fileOf(int square) { return 7 - square % 8; }
+
+constexpr Bitboard squareBB(int square) { return 1ULL << square; }
+
+// Number of set bits -> number of pieces on a bitboard
+constexpr int popCount(Bitboard bb) { return std::popcount(bb); }
+
+// Index of lowest set bit (bb must not be 0)
+constexpr int lsb(Bitboard bb) { return std::countr_zero(bb); }
+
+// Index of highest set bit (bb must not be 0)
+constexpr int msb(Bitboard bb) { return 63 - std::countl_zero(bb); }
+
+// Return lowest set bit and remove it from bb -> used to iterate squares
+constexpr int popLsb(Bitboard &bb) {
+    int square = lsb(bb);
+    bb &= bb - 1;
+    return square;
+}
+
+} // namespace chess::core
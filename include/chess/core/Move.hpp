@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "Piece.hpp"
+
+namespace chess::core {
+
+/**
+ * A single move from one square to another
+ *  - Squares use the mapping from documents/board_setup.md
+ *  - promotion is PieceType::Count when the move is not a promotion
+ *  - A default constructed move (0 -> 0) is the "null" move
+ */
+struct Move {
+    std::uint8_t from = 0;
+    std::uint8_t to = 0;
+    PieceType promotion = PieceType::Count;
+
+    bool isNull() const { return from == to; }
+    bool isPromotion() const { return promotion != PieceType::Count; }
+
+    bool operator==(const Move &) const = default;
+};
+
+/**
+ * Fixed capacity list of moves
+ *  - Lives on the stack -> no heap allocation per node in search
+ *  - Storage is left uninitialised, only push writes moves -> creating a
+ *    list costs nothing but setting count
+ *  - 256 is above the maximum number of moves in any legal position (218)
+ */
+class MoveList {
+  public:
+    static constexpr std::size_t CAPACITY = 256;
+
+    void push(const Move &move) { data()[count++] = move; }
+    void clear() { count = 0; }
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    Move &operator[](std::size_t i) { return data()[i]; }
+    const Move &operator[](std::size_t i) const { return data()[i]; }
+
+    Move *begin() { return data(); }
+    Move *end() { return data() + count; }
+    const Move *begin() const { return data(); }
+    const Move *end() const { return data() + count; }
+
+  private:
+    // Move is an implicit-lifetime type: the byte buffer holds a Move array
+    Move *data() { return std::launder(reinterpret_cast<Move *>(storage)); }
+    const Move *data() const {
+        return std::launder(reinterpret_cast<const Move *>(storage));
+    }
+
+    alignas(Move) std::byte storage[CAPACITY * sizeof(Move)];
+    std::size_t count = 0;
+};
+
+} // namespace chess::core
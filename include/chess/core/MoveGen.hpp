@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Move.hpp"
+#include "Piece.hpp"
+#include "Position.hpp"
+
+/**
+ * Pseudo-legal move generation
+ *  - Moves may leave own king in check, callers filter with isSquareAttacked
+ *  - Castling and en passant are not tracked by Position yet -> not generated
+ */
+namespace chess::core {
+
+enum class GenType : std::uint8_t {
+    Captures, // Captures and every promotion (moves searched by quiescence)
+    Quiets,   // Everything not in Captures
+    Evasions, // In check: king moves, captures / blocks of the checker
+    All,      // Captures + Quiets
+};
+
+/**
+ * Generators specialised at compile time
+ *  - Us fixes pawn direction, promotion rank and shifts as constants
+ *  - Type drops the target squares the generation type does not want
+ *  - Evasions is meant for positions where Us is in check, otherwise it
+ *    generates the same moves as All
+ *
+ * @params position - position to generate from, Us must be the side to move
+ *         moves - list the moves are appended to
+ */
+template <Color Us, GenType Type>
+void generate(const Position &position, MoveList &moves);
+
+// Dispatch once on the side to move into the specialised generator
+template <GenType Type>
+void generate(const Position &position, MoveList &moves) {
+    if (position.sideToMove() == Color::White)
+        generate<Color::White, Type>(position, moves);
+    else
+        generate<Color::Black, Type>(position, moves);
+}
+
+/**
+ * Runtime dispatched generator (GenType::All)
+ *  - Same tables and set-wise pawns as generate<Us, All>, but side to move,
+ *    directions and piece type are runtime values
+ *  - Kept as reference for the specialised generators and for benchmarks
+ */
+void generateMoves(const Position &position, MoveList &moves);
+
+// Check if square is attacked by any piece of color "by"
+bool isSquareAttacked(const Position &position, int squareIdx, Color by);
+
+// Check if king of given color is attacked
+bool inCheck(const Position &position, Color color);
+
+/**
+ * Check if a move (i.e. from a previous search) could be generated here
+ *  - Cheaper than generating every move and searching the list
+ *  - Same rules as generate<All>, own king safety is not checked
+ */
+bool isPseudoLegal(const Position &position, const Move &move);
+
+// Check if move lands on a piece of the opposite color
+bool isCapture(const Position &position, const Move &move);
+
+} // namespace chess::core
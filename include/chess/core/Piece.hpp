@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint> // For fix integer bits
+
+namespace chess::core {
+
+// Use scoped enums to represent color types and piece types
+//  - Better readablity: Must use scopes
+//  - Type safety
+
+enum class Color : std::uint8_t {
+    White = 0,
+    Black = 1,
+    Count // Keep track of count in enum
+};
+
+enum class PieceType : std::uint8_t {
+    King = 0,
+    Queen = 1,
+    Bishop = 2,
+    Knight = 3,
+    Rook = 4,
+    Pawn = 5,
+    Count // Keep track of count in enum
+};
+
+// Flip the side (White <-> Black)
+constexpr Color opposite(Color color) {
+    return color == Color::White ? Color::Black : Color::White;
+}
+
+} // namespace chess::core
@@ -12,32 +12,15 @@
 #include <string>
 #include <vector>
 
+#include "Move.hpp"
+#include "Piece.hpp"
+
 /**
  * Holds a snapshot of current Position
  * Used to keep track of positions and board logic
  */
 namespace chess::core {
 
-// Use scoped enums to represent color types and piece types
-//  - Better readablity: Must use scopes
-//  - Type safety
-
-enum class Color : std::uint8_t {
-    White = 0,
-    Black = 1,
-    Count // Keep track of count in enum
-};
-
-enum class PieceType : std::uint8_t {
-    King = 0,
-    Queen = 1,
-    Bishop = 2,
-    Knight = 3,
-    Rook = 4,
-    Pawn = 5,
-    Count // Keep track of count in enum
-};
-
 struct PieceOnSquare {
     Color color;
     PieceType piece;
@@ -70,6 +53,11 @@ class Position {
     // Return occupied bitboard squares
     std::uint64_t getOccupied() const;
 
+    // Return square of the king of given color (-1 if there is none)
+    int getKingSquare(Color color) const;
+
+    Color sideToMove() const { return side_to_move; }
+
     /* =============== UI GETTERS =============== */
     /**
      * Return info about all possible pieces - 32 pieces
@@ -84,6 +72,9 @@ class Position {
     /* =============== LOGICAL GAME MOVES =============== */
     // Move one piece square to square
     void makeMove(int current_square, int final_square);
+
+    // Move one piece and replace it with the promotion piece if there is one
+    void makeMove(const Move &move);
     bool findPieceAt(int squareIdx, Color &outColor, PieceType &outPiece) const;
 
   private:
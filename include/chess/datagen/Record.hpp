@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../core/Position.hpp"
+
+/**
+ * Training data records
+ *  - One fixed size record per position, written raw (little endian hosts)
+ *  - Scores and results are from White's point of view
+ */
+namespace chess::datagen {
+
+// Game result from White's point of view
+enum class Result : std::int8_t {
+    BlackWin = -1,
+    Draw = 0,
+    WhiteWin = 1,
+};
+
+/**
+ * 32 byte packed position
+ *  - occupancy: every occupied square (mapping from documents/board_setup.md)
+ *  - pieces: one nibble per occupied square, in increasing square order,
+ *    value = color * 6 + PieceType (max 32 pieces -> 16 bytes)
+ */
+struct PackedRecord {
+    std::uint64_t occupancy = 0;
+    std::array<std::uint8_t, 16> pieces{};
+    std::int16_t score = 0;  // Search score in centipawns
+    std::uint16_t ply = 0;   // Ply of the game the position was reached at
+    std::int8_t result = 0;  // Result, filled in when the game is over
+    std::uint8_t sideToMove = 0;
+    std::array<std::uint8_t, 2> padding{};
+};
+
+static_assert(sizeof(PackedRecord) == 32, "PackedRecord must stay 32 bytes");
+static_assert(std::is_trivially_copyable_v<PackedRecord>);
+static_assert(std::endian::native == std::endian::little,
+              "Records are written raw and must be little endian");
+
+// Pack position (at most 32 pieces) with its score from White's view
+PackedRecord pack(const core::Position &position, int whiteScore, int ply);
+
+/**
+ * FEN (placement + side to move) of a packed record, for inspection
+ *  - Throws std::runtime_error on records that cannot come from pack
+ *    (more than 32 pieces or an invalid piece nibble)
+ */
+std::string toFen(const PackedRecord &record);
+
+/**
+ * Buffered record writer
+ *  - Collects records in memory and writes them in large blocks
+ *  - Not thread safe: every generating thread owns its own writer
+ *  - write/flush throw std::runtime_error when the file cannot be written,
+ *    the destructor only flushes on a best effort basis
+ */
+class RecordWriter {
+  public:
+    explicit RecordWriter(const std::string &path,
+                          std::size_t bufferRecords = 16384);
+    ~RecordWriter();
+
+    RecordWriter(const RecordWriter &) = delete;
+    RecordWriter &operator=(const RecordWriter &) = delete;
+
+    void write(const PackedRecord &record);
+    void flush();
+
+  private:
+    std::string path;
+    std::ofstream file;
+    std::vector<PackedRecord> buffer;
+};
+
+// Read every record of a file, throws if it is not a whole number of records
+std::vector<PackedRecord> readRecords(const std::string &path);
+
+} // namespace chess::datagen
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Stats.hpp"
+
+/**
+ * Deterministic benchmark
+ *  - Searches a fixed set of positions to a fixed depth
+ *  - Total node count is the "signature": it only changes when search
+ *    behavior changes, so it is used to check that a commit is a pure speedup
+ *  - Same workload is used as training run for PGO builds
+ */
+namespace chess::engine {
+
+constexpr int DEFAULT_BENCH_DEPTH = 5;
+
+struct BenchResult {
+    std::uint64_t nodes = 0;
+    double seconds = 0.0;
+    std::uint64_t nodesPerSecond = 0;
+    SearchStats stats; // Summed over all positions
+};
+
+// Fixed list of bench positions (FEN strings)
+const std::vector<std::string> &benchPositions();
+
+/**
+ * Run the bench and report progress / totals to out
+ *
+ * @params depth - search depth for every position
+ *         out - stream for the per position lines and the summary
+ */
+BenchResult runBench(int depth, std::ostream &out);
+
+} // namespace chess::engine
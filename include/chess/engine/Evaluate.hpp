@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../core/Piece.hpp"
+#include "../core/Position.hpp"
+
+namespace chess::engine {
+
+// Centipawn value of each piece, indexed by PieceType
+constexpr int PIECE_VALUES[] = {
+    0,   // King
+    900, // Queen
+    330, // Bishop
+    320, // Knight
+    500, // Rook
+    100, // Pawn
+};
+
+constexpr int pieceValue(core::PieceType piece) {
+    return PIECE_VALUES[static_cast<int>(piece)];
+}
+
+/**
+ * Static evaluation of a position
+ *  - Material + small centralization / pawn advancement bonuses
+ *
+ * @returns score in centipawns from the side to move's point of view
+ */
+int evaluate(const core::Position &position);
+
+} // namespace chess::engine
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../core/Move.hpp"
+#include "../core/Piece.hpp"
+#include "../core/Position.hpp"
+
+namespace chess::engine {
+
+/**
+ * History heuristic
+ *  - Score for quiet moves that caused beta cutoffs, indexed [color][from][to]
+ *  - Saturates at MAX so old scores decay as new bonuses come in
+ */
+class HistoryTable {
+  public:
+    static constexpr int MAX = 16384;
+
+    int get(core::Color color, const core::Move &move) const {
+        return table[static_cast<std::size_t>(color)][move.from][move.to];
+    }
+
+    void update(core::Color color, const core::Move &move, int bonus);
+    void clear() { table = {}; }
+
+  private:
+    std::array<std::array<std::array<int, 64>, 64>,
+               static_cast<std::size_t>(core::Color::Count)>
+        table{};
+};
+
+/**
+ * Staged, lazy move picker
+ *  - Hands out one pseudo-legal move at a time, best first
+ *  - Moves of a stage are only generated when the previous stages are used
+ *    up -> a cut node failing high on the TT move generates nothing
+ *  - Stages: TT move, good captures (MVV-LVA), killers, quiets (history),
+ *    bad captures. In check: TT move, then all evasions
+ *  - Selection by partial sort: each call picks the best remaining move
+ *  - Callers still have to reject moves leaving their king in check
+ */
+class MovePicker {
+  public:
+    /**
+     * Main search picker
+     *
+     * @params position - position to pick moves for
+     *         ttMove - move to try first, ignored if null or not pseudo-legal
+     *         killers - quiet moves that caused cutoffs at the same ply
+     *         history - quiet move scores
+     */
+    MovePicker(const core::Position &position, const core::Move &ttMove,
+               const std::array<core::Move, 2> &killers,
+               const HistoryTable &history);
+
+    // Quiescence picker: captures and promotions only
+    explicit MovePicker(const core::Position &position);
+
+    // Next move to search, null move when every stage is used up
+    core::Move next();
+
+    // Number of moves generated so far (work done by the picker)
+    std::size_t generated() const { return generatedCount; }
+
+  private:
+    enum class Stage : std::uint8_t {
+        TTMove,
+        GenerateCaptures,
+        GoodCaptures,
+        FirstKiller,
+        SecondKiller,
+        GenerateQuiets,
+        Quiets,
+        BadCaptures,
+        GenerateEvasions,
+        Evasions,
+        QGenerateCaptures,
+        QCaptures,
+        Done,
+    };
+
+    // Score moves[current, end) for the stage being entered
+    void scoreCaptures();
+    void scoreQuiets();
+    void scoreEvasions();
+
+    // Swap best scored move of [current, end) to current and return it
+    core::Move pickBest();
+
+    // Moves already handed out by an earlier stage
+    bool isSpecial(const core::Move &move) const;
+
+    const core::Position &position;
+    const HistoryTable *history = nullptr; // Null for quiescence
+    core::Move ttMove;
+    std::array<core::Move, 2> killers;
+
+    Stage stage;
+    core::MoveList moves;
+    std::array<int, core::MoveList::CAPACITY> scores; // Set per stage
+    std::size_t current = 0;
+    std::size_t end = 0;
+
+    // Captures losing material to a recapture, searched after quiets
+    //  - Kept in moves[0, badEnd): slots of captures already handed out
+    std::size_t badEnd = 0;
+    std::size_t badCurrent = 0;
+
+    std::size_t generatedCount = 0;
+};
+
+} // namespace chess::engine
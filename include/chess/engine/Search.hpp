@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "../core/Move.hpp"
+#include "../core/Position.hpp"
+#include "MovePicker.hpp"
+#include "Stats.hpp"
+
+namespace chess::engine {
+
+constexpr int INFINITE_SCORE = 32001;
+constexpr int MATE_SCORE = 32000;
+constexpr int MAX_PLY = 128;
+
+struct SearchLimits {
+    int depth = 1; // At least depth 1 is always searched
+    std::uint64_t nodes = 0; // 0 = no node limit
+};
+
+struct SearchResult {
+    core::Move bestMove{};
+    int score = 0;
+    int depth = 0; // Last fully completed depth
+    std::uint64_t nodes = 0;
+};
+
+/**
+ * Parse a search depth typed by the user (bench, go depth)
+ *
+ * @params text - depth as typed by the user
+ *         depth - set to the parsed depth on success
+ * @returns false if text is not a number between 1 and MAX_PLY - 1
+ */
+bool parseDepth(const std::string &text, int &depth);
+
+/**
+ * Fixed depth alpha-beta search
+ *  - Iterative deepening from depth 1 to limits.depth
+ *  - The node limit only applies once depth 1 is complete: a position with
+ *    legal moves always gets a searched best move and score
+ *  - Negamax with quiescence search on captures and promotions
+ *  - Moves come from a staged MovePicker: previous iteration's best move at
+ *    the root, killers and history for quiets
+ *  - Single threaded: run one Searcher per thread
+ */
+class Searcher {
+  public:
+    /**
+     * Search the position until the depth or node limit is reached
+     *
+     * @params position - root position
+     *         limits - depth and node limits
+     * @returns best move and score of the last completed iteration
+     */
+    SearchResult search(const core::Position &position,
+                        const SearchLimits &limits);
+
+    // Statistics of the last search (only counted when CHESS_STATS is on)
+    const SearchStats &getStats() const { return searchStats; }
+
+  private:
+    int negamax(const core::Position &position, int depth, int alpha, int beta,
+                int ply);
+    int quiescence(const core::Position &position, int alpha, int beta,
+                   int ply);
+
+    // Count node and check node limit
+    bool visitNode();
+
+    // Remember quiet move that caused a beta cutoff
+    void updateQuietCutoff(core::Color us, const core::Move &move, int depth,
+                           int ply);
+
+    std::uint64_t nodes = 0;
+    std::uint64_t nodeLimit = 0;
+    bool stopped = false;
+
+    core::Move rootBestMove{};
+    core::Move previousBestMove{}; // Best root move of the last iteration
+
+    // Quiet moves that caused cutoffs, two per ply
+    std::array<std::array<core::Move, 2>, MAX_PLY> killers{};
+    HistoryTable history;
+
+    SearchStats searchStats;
+};
+
+} // namespace chess::engine
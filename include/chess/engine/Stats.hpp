@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Search statistics
+ *  - Enabled at compile time with -DCHESS_STATS=ON (defines CHESS_STATS=1)
+ *  - Phase timers need -DCHESS_STATS_TIMERS=ON as well: they read the clock
+ *    twice per timed call, the counters alone are near free
+ *  - When off every CHESS_STAT_* macro expands to nothing -> zero cost
+ *  - Every Searcher owns its own SearchStats (no sharing between threads),
+ *    totals over threads are built with merge()
+ */
+namespace chess::engine {
+
+#if defined(CHESS_STATS) && CHESS_STATS
+constexpr bool STATS_ENABLED = true;
+#else
+constexpr bool STATS_ENABLED = false;
+#endif
+
+#if defined(CHESS_STATS_TIMERS) && CHESS_STATS_TIMERS
+constexpr bool STATS_TIMERS_ENABLED = STATS_ENABLED;
+#else
+constexpr bool STATS_TIMERS_ENABLED = false;
+#endif
+
+// Parts of the search that get timed
+enum class Phase : std::uint8_t {
+    MovePicking = 0, // Generating, scoring and selecting moves
+    Evaluate = 1,
+    Count // Keep track of count in enum
+};
+
+struct SearchStats {
+    std::uint64_t nodes = 0;            // Main search nodes
+    std::uint64_t qnodes = 0;           // Quiescence nodes
+    std::uint64_t betaCutoffs = 0;      // Main search fail highs
+    std::uint64_t firstMoveCutoffs = 0; // Fail highs on the first legal move
+    std::uint64_t illegalMoves = 0;     // Pseudo-legal moves rejected
+    std::uint64_t movesGenerated = 0;   // Moves generated by move pickers
+
+    // Nanoseconds spent per phase, indexed by Phase (CHESS_STATS_TIMERS only)
+    std::array<std::uint64_t, static_cast<std::size_t>(Phase::Count)>
+        phaseNanos{};
+
+    // Add counters of other (i.e. from another thread) into this one
+    void merge(const SearchStats &other);
+
+    void reset() { *this = SearchStats{}; }
+
+    // Share of fail highs produced by the first move (ordering quality)
+    double firstMoveCutoffRate() const;
+
+    // Single line JSON object with every counter
+    std::string toJson() const;
+};
+
+/**
+ * RAII timer adding elapsed time to one phase on destruction
+ */
+class PhaseTimer {
+  public:
+    PhaseTimer(SearchStats &stats, Phase phase)
+        : stats(stats), phase(phase),
+          start(std::chrono::steady_clock::now()) {}
+
+    ~PhaseTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        stats.phaseNanos[static_cast<std::size_t>(phase)] += static_cast<
+            std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count());
+    }
+
+    PhaseTimer(const PhaseTimer &) = delete;
+    PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+  private:
+    SearchStats &stats;
+    Phase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace chess::engine
+
+// --- Instrumentation macros, used in the hot path
+#define CHESS_STAT_CONCAT_INNER(a, b) a##b
+#define CHESS_STAT_CONCAT(a, b) CHESS_STAT_CONCAT_INNER(a, b)
+
+#if defined(CHESS_STATS) && CHESS_STATS
+#define CHESS_STAT_INC(stats, counter) (++(stats).counter)
+#define CHESS_STAT_ADD(stats, counter, value) ((stats).counter += (value))
+#else
+#define CHESS_STAT_INC(stats, counter) ((void)0)
+#define CHESS_STAT_ADD(stats, counter, value) ((void)0)
+#endif
+
+#if defined(CHESS_STATS) && CHESS_STATS && defined(CHESS_STATS_TIMERS) &&      \
+    CHESS_STATS_TIMERS
+#define CHESS_STAT_TIMER(stats, phase)                                         \
+    chess::engine::PhaseTimer CHESS_STAT_CONCAT(chess_stat_timer_,             \
+                                                __LINE__)(stats, phase)
+#else
+#define CHESS_STAT_TIMER(stats, phase) ((void)0)
+#endif
@@ -0,0 +1,344 @@
+#include "../../include/chess/core/MoveGen.hpp"
+#include "../../include/chess/core/Attacks.hpp"
+#include "../../include/chess/core/Bitboard.hpp"
+
+#include <utility>
+
+namespace chess::core {
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+constexpr PieceType PROMOTIONS[] = {PieceType::Queen, PieceType::Rook,
+                                    PieceType::Bishop, PieceType::Knight};
+
+void push_move(MoveList &moves, int from, int to) {
+    moves.push(
+        {static_cast<std::uint8_t>(from), static_cast<std::uint8_t>(to)});
+}
+
+void push_promotions(MoveList &moves, int from, int to) {
+    for (PieceType promotion : PROMOTIONS)
+        moves.push({static_cast<std::uint8_t>(from),
+                    static_cast<std::uint8_t>(to), promotion});
+}
+
+// Squares a non pawn piece on square attacks
+Bitboard piece_attacks(PieceType piece, int square, Bitboard occupied) {
+    switch (piece) {
+    case PieceType::King:
+        return KING_ATTACKS[square];
+    case PieceType::Knight:
+        return KNIGHT_ATTACKS[square];
+    case PieceType::Bishop:
+        return bishopAttacks(square, occupied);
+    case PieceType::Rook:
+        return rookAttacks(square, occupied);
+    case PieceType::Queen:
+        return queenAttacks(square, occupied);
+    default:
+        return 0ULL;
+    }
+}
+
+template <PieceType Piece>
+constexpr Bitboard piece_attacks(int square, Bitboard occupied) {
+    if constexpr (Piece == PieceType::King)
+        return KING_ATTACKS[square];
+    else if constexpr (Piece == PieceType::Knight)
+        return KNIGHT_ATTACKS[square];
+    else if constexpr (Piece == PieceType::Bishop)
+        return bishopAttacks(square, occupied);
+    else if constexpr (Piece == PieceType::Rook)
+        return rookAttacks(square, occupied);
+    else
+        return queenAttacks(square, occupied);
+}
+
+// Every piece of color "by" attacking square
+Bitboard attackers_to(const Position &position, int square, Color by,
+                      Bitboard occupied) {
+    Bitboard queens = position.getPieces(by, PieceType::Queen);
+
+    // Attacks are symmetric: a piece on square attacks the attacker back.
+    // Except for pawns: look from the defending side's pawn
+    return (KNIGHT_ATTACKS[square] &
+            position.getPieces(by, PieceType::Knight)) |
+           (KING_ATTACKS[square] & position.getPieces(by, PieceType::King)) |
+           (pawnAttacks(opposite(by), square) &
+            position.getPieces(by, PieceType::Pawn)) |
+           (bishopAttacks(square, occupied) &
+            (position.getPieces(by, PieceType::Bishop) | queens)) |
+           (rookAttacks(square, occupied) &
+            (position.getPieces(by, PieceType::Rook) | queens));
+}
+
+/* ========= SPECIALISED GENERATORS ========= */
+template <Color Us, PieceType Piece>
+void generate_piece_moves(const Position &position, MoveList &moves,
+                          Bitboard targets) {
+    Bitboard occupied = position.getOccupied();
+    Bitboard pieces = position.getPieces(Us, Piece);
+
+    while (pieces) {
+        int from = popLsb(pieces);
+        Bitboard attacks = piece_attacks<Piece>(from, occupied) & targets;
+        while (attacks)
+            push_move(moves, from, popLsb(attacks));
+    }
+}
+
+// Emit pawn moves whose destinations are Offset squares from their pawn
+template <int Offset>
+void push_pawn_moves(MoveList &moves, Bitboard destinations) {
+    while (destinations) {
+        int to = popLsb(destinations);
+        push_move(moves, to - Offset, to);
+    }
+}
+
+template <int Offset>
+void push_pawn_promotions(MoveList &moves, Bitboard destinations) {
+    while (destinations) {
+        int to = popLsb(destinations);
+        push_promotions(moves, to - Offset, to);
+    }
+}
+
+/**
+ * Pawn moves, set-wise: all pawns are shifted at once
+ *
+ * @params targets - allowed destinations for Evasions (checker + block
+ *                   squares), ignored for other generation types
+ */
+template <Color Us, GenType Type>
+void generate_pawn_moves(const Position &position, MoveList &moves,
+                         Bitboard targets) {
+    constexpr Color Them = opposite(Us);
+    constexpr Direction Up =
+        Us == Color::White ? Direction::North : Direction::South;
+    constexpr Direction UpEast =
+        Us == Color::White ? Direction::NorthEast : Direction::SouthEast;
+    constexpr Direction UpWest =
+        Us == Color::White ? Direction::NorthWest : Direction::SouthWest;
+    constexpr Bitboard PromotionRank = rankBB(Us == Color::White ? 7 : 0);
+    // Rank a pawn lands on after its first single push from the start rank
+    constexpr Bitboard DoublePushRank = rankBB(Us == Color::White ? 2 : 5);
+
+    Bitboard pawns = position.getPieces(Us, PieceType::Pawn);
+    Bitboard empty = ~position.getOccupied();
+    Bitboard enemies = position.getOccupied(Them);
+
+    if constexpr (Type != GenType::Evasions)
+        targets = ~0ULL;
+
+    Bitboard single = shift<Up>(pawns) & empty;
+
+    // --- Quiet pushes (no promotion)
+    if constexpr (Type != GenType::Captures) {
+        Bitboard doubles = shift<Up>(single & DoublePushRank) & empty;
+        Bitboard pushes = single & ~PromotionRank;
+
+        push_pawn_moves<offset(Up)>(moves, pushes & targets);
+        push_pawn_moves<2 * offset(Up)>(moves, doubles & targets);
+    }
+
+    // --- Captures and promotions
+    if constexpr (Type != GenType::Quiets) {
+        Bitboard east = shift<UpEast>(pawns) & enemies & targets;
+        Bitboard west = shift<UpWest>(pawns) & enemies & targets;
+
+        push_pawn_moves<offset(UpEast)>(moves, east & ~PromotionRank);
+        push_pawn_moves<offset(UpWest)>(moves, west & ~PromotionRank);
+
+        push_pawn_promotions<offset(Up)>(moves,
+                                         single & PromotionRank & targets);
+        push_pawn_promotions<offset(UpEast)>(moves, east & PromotionRank);
+        push_pawn_promotions<offset(UpWest)>(moves, west & PromotionRank);
+    }
+}
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+template <Color Us, GenType Type>
+void generate(const Position &position, MoveList &moves) {
+    constexpr Color Them = opposite(Us);
+
+    Bitboard occupied = position.getOccupied();
+    Bitboard own = position.getOccupied(Us);
+    Bitboard enemies = position.getOccupied(Them);
+
+    // Destinations allowed for king / other pieces
+    Bitboard king_targets = Type == GenType::Captures ? enemies
+                            : Type == GenType::Quiets ? ~occupied
+                                                      : ~own;
+    Bitboard targets = king_targets;
+
+    if constexpr (Type == GenType::Evasions) {
+        int king = position.getKingSquare(Us);
+        Bitboard checkers =
+            king == -1 ? 0ULL : attackers_to(position, king, Them, occupied);
+
+        // Not in check (or no king): every move is an evasion
+        if (!checkers) {
+            generate<Us, GenType::All>(position, moves);
+            return;
+        }
+
+        generate_piece_moves<Us, PieceType::King>(position, moves,
+                                                  king_targets);
+
+        // Double check: only the king can move
+        if (popCount(checkers) > 1)
+            return;
+
+        // Capture the checker or block between it and the king
+        targets = checkers | BETWEEN_BB[king][lsb(checkers)];
+    } else {
+        generate_piece_moves<Us, PieceType::King>(position, moves,
+                                                  king_targets);
+    }
+
+    generate_piece_moves<Us, PieceType::Queen>(position, moves, targets);
+    generate_piece_moves<Us, PieceType::Bishop>(position, moves, targets);
+    generate_piece_moves<Us, PieceType::Knight>(position, moves, targets);
+    generate_piece_moves<Us, PieceType::Rook>(position, moves, targets);
+    generate_pawn_moves<Us, Type>(position, moves, targets);
+}
+
+// Explicit instantiations: every color x generation type
+template void generate<Color::White, GenType::Captures>(const Position &,
+                                                        MoveList &);
+template void generate<Color::White, GenType::Quiets>(const Position &,
+                                                      MoveList &);
+template void generate<Color::White, GenType::Evasions>(const Position &,
+                                                        MoveList &);
+template void generate<Color::White, GenType::All>(const Position &,
+                                                   MoveList &);
+template void generate<Color::Black, GenType::Captures>(const Position &,
+                                                        MoveList &);
+template void generate<Color::Black, GenType::Quiets>(const Position &,
+                                                      MoveList &);
+template void generate<Color::Black, GenType::Evasions>(const Position &,
+                                                        MoveList &);
+template void generate<Color::Black, GenType::All>(const Position &,
+                                                   MoveList &);
+
+void generateMoves(const Position &position, MoveList &moves) {
+    Color us = position.sideToMove();
+    Bitboard occupied = position.getOccupied();
+    Bitboard own = position.getOccupied(us);
+    Bitboard enemies = position.getOccupied(opposite(us));
+
+    // Every piece but pawns moves to the squares it attacks
+    for (PieceType piece : {PieceType::King, PieceType::Queen,
+                            PieceType::Bishop, PieceType::Knight,
+                            PieceType::Rook}) {
+        Bitboard pieces = position.getPieces(us, piece);
+        while (pieces) {
+            int from = popLsb(pieces);
+            Bitboard targets = piece_attacks(piece, from, occupied) & ~own;
+            while (targets)
+                push_move(moves, from, popLsb(targets));
+        }
+    }
+
+    // Pawns set-wise like generate_pawn_moves, but every direction and
+    // rank is a runtime value
+    bool white = us == Color::White;
+    Direction up = white ? Direction::North : Direction::South;
+    Direction up_east = white ? Direction::NorthEast : Direction::SouthEast;
+    Direction up_west = white ? Direction::NorthWest : Direction::SouthWest;
+    Bitboard promotion_rank = rankBB(white ? 7 : 0);
+    Bitboard double_push_rank = rankBB(white ? 2 : 5);
+
+    Bitboard pawns = position.getPieces(us, PieceType::Pawn);
+    Bitboard empty = ~occupied;
+
+    Bitboard single = shift(pawns, up) & empty;
+    Bitboard doubles = shift(single & double_push_rank, up) & empty;
+    Bitboard east = shift(pawns, up_east) & enemies;
+    Bitboard west = shift(pawns, up_west) & enemies;
+
+    // Destinations and how far each one is from its pawn
+    const std::pair<Bitboard, int> quiets_and_captures[] = {
+        {single & ~promotion_rank, offset(up)},
+        {doubles, 2 * offset(up)},
+        {east & ~promotion_rank, offset(up_east)},
+        {west & ~promotion_rank, offset(up_west)},
+    };
+    const std::pair<Bitboard, int> promotions[] = {
+        {single & promotion_rank, offset(up)},
+        {east & promotion_rank, offset(up_east)},
+        {west & promotion_rank, offset(up_west)},
+    };
+
+    for (auto [destinations, pawn_offset] : quiets_and_captures) {
+        while (destinations) {
+            int to = popLsb(destinations);
+            push_move(moves, to - pawn_offset, to);
+        }
+    }
+
+    for (auto [destinations, pawn_offset] : promotions) {
+        while (destinations) {
+            int to = popLsb(destinations);
+            push_promotions(moves, to - pawn_offset, to);
+        }
+    }
+}
+
+bool isSquareAttacked(const Position &position, int squareIdx, Color by) {
+    return attackers_to(position, squareIdx, by, position.getOccupied()) != 0;
+}
+
+bool inCheck(const Position &position, Color color) {
+    int king = position.getKingSquare(color);
+    return king != -1 && isSquareAttacked(position, king, opposite(color));
+}
+
+bool isPseudoLegal(const Position &position, const Move &move) {
+    Color us = position.sideToMove();
+    Color color;
+    PieceType piece;
+
+    if (move.isNull() || !position.findPieceAt(move.from, color, piece) ||
+        color != us || (position.getOccupied(us) & squareBB(move.to)))
+        return false;
+
+    Bitboard occupied = position.getOccupied();
+    Bitboard to = squareBB(move.to);
+
+    if (piece != PieceType::Pawn)
+        return !move.isPromotion() &&
+               (piece_attacks(piece, move.from, occupied) & to);
+
+    int forward =
+        offset(us == Color::White ? Direction::North : Direction::South);
+    int start_rank = us == Color::White ? 1 : 6;
+    int last_rank = us == Color::White ? 7 : 0;
+
+    // Pawns reaching the last rank must promote (to Q, R, B or N)
+    bool promotes = rankOf(move.to) == last_rank;
+    if (promotes != move.isPromotion() || move.promotion == PieceType::King ||
+        move.promotion == PieceType::Pawn)
+        return false;
+
+    if (pawnAttacks(us, move.from) & to)
+        return (position.getOccupied(opposite(us)) & to) != 0;
+
+    int one = move.from + forward;
+    if (occupied & squareBB(one))
+        return false;
+
+    return move.to == one || (rankOf(move.from) == start_rank &&
+                              move.to == one + forward && !(occupied & to));
+}
+
+bool isCapture(const Position &position, const Move &move) {
+    return (position.getOccupied(opposite(position.sideToMove())) &
+            squareBB(move.to)) != 0;
+}
+
+} // namespace chess::core
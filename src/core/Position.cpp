@@ -1,4 +1,5 @@
 #include "../../include/chess/core/Position.hpp"
+#include "../../include/chess/core/Bitboard.hpp"
 #include <cstdint>
 #include <cwctype>
 #include <iomanip>
@@ -15,10 +16,6 @@ constexpr std::size_t idx(Color c) { return static_cast<std::size_t>(c); }
 
 constexpr std::size_t idx(PieceType p) { return static_cast<std::size_t>(p); }
 
-// Mapping: refer to dcouments/board-setup.md
-// Convert rank and file to square integers
-// rank & file -> 0-7
-constexpr int square_index(int rank, int file) { return rank * 8 + (7 - file); }
 
 } // namespace
 /* ======================= ANONYMOUS NAMESPACE ======================= */
@@ -41,9 +38,22 @@ std::uint64_t Position::getPieces(PieceType piece) const {
            bit_boards[idx(Color::Black)][idx(piece)];
 }
 
-std::uint64_t Position::getOccupied(Color color) const { return 0ULL; }
+std::uint64_t Position::getOccupied(Color color) const {
+    std::uint64_t occupied = 0ULL;
+    for (const std::uint64_t bit_board : bit_boards[idx(color)])
+        occupied |= bit_board;
 
-std::uint64_t Position::getOccupied() const { return 0ULL; }
+    return occupied;
+}
+
+std::uint64_t Position::getOccupied() const {
+    return getOccupied(Color::White) | getOccupied(Color::Black);
+}
+
+int Position::getKingSquare(Color color) const {
+    std::uint64_t king = bit_boards[idx(color)][idx(PieceType::King)];
+    return king ? __builtin_ctzll(king) : -1;
+}
 
 std::vector<PieceOnSquare> Position::getAllPieces() const {
     std::vector<PieceOnSquare> returner;
@@ -161,7 +171,7 @@ void Position::parse_fen(const std::string &fen) {
                 continue;
             }
 
-            int squareIdx = square_index(rank, file);
+            int squareIdx = squareIndex(rank, file);
             std::uint64_t temp = 1ULL; // 64 bit integer with LSB set to 1
             temp = temp << squareIdx;  // Shift over the 1 bit to its designated
                                        // bit representing the square index
@@ -226,13 +236,28 @@ void Position::makeMove(int current_square, int final_square) {
     side_to_move = (side_to_move == Color::White) ? Color::Black : Color::White;
 }
 
+void Position::makeMove(const Move &move) {
+    makeMove(move.from, move.to);
+
+    if (!move.isPromotion())
+        return;
+
+    // Mover is the side that just moved (side_to_move was already flipped)
+    Color mover = opposite(side_to_move);
+    std::uint64_t toBB = 1ULL << move.to;
+
+    // Swap the pawn that landed on the last rank for the promotion piece
+    bit_boards[idx(mover)][idx(PieceType::Pawn)] &= ~toBB;
+    bit_boards[idx(mover)][idx(move.promotion)] |= toBB;
+}
+
 void Position::print_bitboard(std::uint64_t bb) {
 
     for (int rank = 7; rank >= 0; --rank) {
         std::cout << std::setw(2) << std::to_string(rank + 1) << "  ";
 
         for (int file = 0; file < 8; ++file) {
-            int squareIdx = square_index(rank, file);
+            int squareIdx = squareIndex(rank, file);
 
             std::uint64_t temp = 1ULL << squareIdx; // Shift 1 bit to the bit
                                                     // reffering to square index
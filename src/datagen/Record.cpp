@@ -0,0 +1,145 @@
+#include "../../include/chess/datagen/Record.hpp"
+#include "../../include/chess/core/Bitboard.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace chess::datagen {
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+constexpr int PIECE_TYPES = static_cast<int>(core::PieceType::Count);
+
+// FEN letters indexed by PieceType: King, Queen, Bishop, Knight, Rook, Pawn
+constexpr char FEN_PIECES[] = {'k', 'q', 'b', 'n', 'r', 'p'};
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+PackedRecord pack(const core::Position &position, int whiteScore, int ply) {
+    PackedRecord record;
+    record.occupancy = position.getOccupied();
+    record.score = static_cast<std::int16_t>(
+        std::clamp(whiteScore, -INT16_MAX, static_cast<int>(INT16_MAX)));
+    record.ply = static_cast<std::uint16_t>(ply);
+    record.sideToMove = static_cast<std::uint8_t>(position.sideToMove());
+
+    // Nibbles follow the squares of the occupancy from lowest to highest
+    std::uint64_t occupied = record.occupancy;
+    for (int i = 0; occupied && i < 32; ++i) {
+        int square = core::popLsb(occupied);
+
+        core::Color color;
+        core::PieceType piece;
+        position.findPieceAt(square, color, piece);
+
+        std::uint8_t nibble = static_cast<std::uint8_t>(
+            static_cast<int>(color) * PIECE_TYPES + static_cast<int>(piece));
+        record.pieces[i / 2] |= i % 2 ? nibble << 4 : nibble;
+    }
+
+    return record;
+}
+
+std::string toFen(const PackedRecord &record) {
+    // Square -> FEN letter, '\0' for empty
+    std::array<char, 64> board{};
+
+    // Only 32 nibbles fit in pieces
+    if (core::popCount(record.occupancy) > 32)
+        throw std::runtime_error("Corrupt record: more than 32 pieces");
+
+    std::uint64_t occupied = record.occupancy;
+    for (int i = 0; occupied && i < 32; ++i) {
+        int square = core::popLsb(occupied);
+        int nibble = (record.pieces[i / 2] >> (i % 2 ? 4 : 0)) & 0xF;
+        if (nibble >= 2 * PIECE_TYPES)
+            throw std::runtime_error("Corrupt record: invalid piece");
+
+        char letter = FEN_PIECES[nibble % PIECE_TYPES];
+        board[square] = nibble >= PIECE_TYPES ? letter : letter - 'a' + 'A';
+    }
+
+    // Ranks from 8 to 1, files from a to h, refer to documents/board_setup.md
+    std::string fen;
+    for (int rank = 7; rank >= 0; --rank) {
+        int empty = 0;
+        for (int file = 0; file < 8; ++file) {
+            char letter = board[core::squareIndex(rank, file)];
+            if (!letter) {
+                ++empty;
+                continue;
+            }
+            if (empty)
+                fen += static_cast<char>('0' + empty);
+            empty = 0;
+            fen += letter;
+        }
+        if (empty)
+            fen += static_cast<char>('0' + empty);
+        if (rank)
+            fen += '/';
+    }
+
+    fen += record.sideToMove == 0 ? " w" : " b";
+    return fen;
+}
+
+/* ========= WRITER ========= */
+RecordWriter::RecordWriter(const std::string &path, std::size_t bufferRecords)
+    : path(path), file(path, std::ios::binary | std::ios::trunc) {
+    if (!file)
+        throw std::runtime_error("Failed to open " + path);
+
+    buffer.reserve(bufferRecords);
+}
+
+RecordWriter::~RecordWriter() {
+    // Callers flush explicitly to see errors, never throw from here
+    try {
+        flush();
+    } catch (const std::exception &) {
+    }
+}
+
+void RecordWriter::write(const PackedRecord &record) {
+    buffer.push_back(record);
+    if (buffer.size() == buffer.capacity())
+        flush();
+}
+
+void RecordWriter::flush() {
+    file.write(reinterpret_cast<const char *>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size() *
+                                            sizeof(PackedRecord)));
+    file.flush();
+    buffer.clear();
+
+    if (!file)
+        throw std::runtime_error("Failed to write " + path);
+}
+
+std::vector<PackedRecord> readRecords(const std::string &path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        throw std::runtime_error("Failed to open " + path);
+
+    std::streamsize bytes = file.tellg();
+    file.seekg(0);
+    if (bytes < 0 ||
+        static_cast<std::size_t>(bytes) % sizeof(PackedRecord) != 0)
+        throw std::runtime_error(path + " is not a record file");
+
+    std::vector<PackedRecord> records(
+        static_cast<std::size_t>(bytes) / sizeof(PackedRecord));
+    file.read(reinterpret_cast<char *>(records.data()),
+              static_cast<std::streamsize>(records.size() *
+                                           sizeof(PackedRecord)));
+    if (!file)
+        throw std::runtime_error("Failed to read " + path);
+
+    return records;
+}
+
+} // namespace chess::datagen
@@ -0,0 +1,441 @@
+#include "../../include/chess/core/Bitboard.hpp"
+#include "../../include/chess/core/MoveGen.hpp"
+#include "../../include/chess/core/Position.hpp"
+#include "../../include/chess/datagen/Record.hpp"
+#include "../../include/chess/engine/Search.hpp"
+#include "../../include/chess/engine/Stats.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+using chess::core::Color;
+using chess::core::Move;
+using chess::core::MoveList;
+using chess::core::Position;
+using chess::datagen::PackedRecord;
+using chess::datagen::Result;
+
+const std::string START_FEN =
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+struct Options {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::uint64_t games = 100;      // Total over all threads
+    std::uint64_t nodes = 5000;     // Node limit per move
+    int randomPlies = 8;            // Random moves played before recording
+    int maxPlies = 400;             // Game is adjudicated a draw after this
+    int winScore = 2000;            // Win adjudication score (centipawns) ...
+    int winPlies = 8;               // ... held for this many plies in a row
+    std::uint64_t seed = 1;
+    std::string out = "datagen";    // Files: <out>_<thread>.bin
+};
+
+// Shared between generating threads
+struct Progress {
+    std::atomic<std::uint64_t> gamesStarted{0};
+    std::atomic<std::uint64_t> positions{0};
+    std::atomic<bool> failed{false}; // A worker hit an error, stop all
+
+    std::mutex mutex; // Guards stats and error
+    chess::engine::SearchStats stats; // Totals over all threads
+    std::string error;
+};
+
+// Bad command line: reported together with the usage text
+struct UsageError : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+// Parse a whole argument as a number, throw UsageError if it is not one
+template <typename T> T parse_number(const std::string &name,
+                                     const std::string &text) {
+    T value{};
+    const char *end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, value);
+    if (ec != std::errc() || ptr != end)
+        throw UsageError("invalid value for " + name + ": " + text);
+
+    return value;
+}
+
+// Game over: adjudicate mate scores sooner than playing the mate out
+constexpr int MATE_ADJUDICATION = chess::engine::MATE_SCORE -
+                                  chess::engine::MAX_PLY;
+
+MoveList legal_moves(const Position &position) {
+    MoveList pseudo;
+    chess::core::generate<chess::core::GenType::All>(position, pseudo);
+
+    MoveList legal;
+    for (const Move &move : pseudo) {
+        Position child = position;
+        child.makeMove(move);
+        if (!chess::core::inCheck(child, position.sideToMove()))
+            legal.push(move);
+    }
+    return legal;
+}
+
+// Only kings left: no side can win
+bool bare_kings(const Position &position) {
+    return chess::core::popCount(position.getOccupied()) == 2;
+}
+
+// Same pieces on the same squares with the same side to move
+bool same_position(const PackedRecord &a, const PackedRecord &b) {
+    return a.occupancy == b.occupancy && a.pieces == b.pieces &&
+           a.sideToMove == b.sideToMove;
+}
+
+/**
+ * Threefold repetition
+ *  - Position has no hash or move history: compare packed boards instead,
+ *    cheap next to the searches of a game
+ */
+bool threefold(const std::vector<PackedRecord> &history) {
+    const PackedRecord &current = history.back();
+    return std::count_if(history.begin(), history.end(),
+                         [&](const PackedRecord &record) {
+                             return same_position(record, current);
+                         }) >= 3;
+}
+
+/**
+ * Play random legal moves from the start position
+ *
+ * @returns false when the game ended during the random moves
+ */
+bool random_opening(Position &position, std::mt19937_64 &rng,
+                    int randomPlies) {
+    position = Position(START_FEN);
+    for (int ply = 0; ply < randomPlies; ++ply) {
+        MoveList moves = legal_moves(position);
+        if (moves.empty())
+            return false;
+
+        position.makeMove(moves[rng() % moves.size()]);
+    }
+    return !legal_moves(position).empty();
+}
+
+/**
+ * Play one self-play game and write its positions
+ *  - Positions in check or with a noisy best move are skipped, their score
+ *    says little about the static evaluation
+ *
+ * @returns number of positions written
+ */
+std::uint64_t play_game(const Options &options, std::mt19937_64 &rng,
+                        chess::engine::Searcher &searcher,
+                        chess::engine::SearchStats &stats,
+                        chess::datagen::RecordWriter &writer) {
+    Position position;
+    while (!random_opening(position, rng, options.randomPlies)) {
+    }
+
+    std::vector<PackedRecord> records;
+    std::vector<PackedRecord> history; // Every position of the game
+    Result result = Result::Draw;
+    int winning_plies = 0; // Signed: > 0 White winning, < 0 Black winning
+
+    for (int ply = options.randomPlies;; ++ply) {
+        history.push_back(chess::datagen::pack(position, 0, ply));
+        if (threefold(history))
+            break;
+
+        Color us = position.sideToMove();
+        bool checked = chess::core::inCheck(position, us);
+
+        MoveList moves = legal_moves(position);
+        if (moves.empty()) {
+            // Checkmate: side to move lost. Stalemate: draw
+            if (checked)
+                result = us == Color::White ? Result::BlackWin
+                                            : Result::WhiteWin;
+            break;
+        }
+
+        if (ply >= options.maxPlies || bare_kings(position))
+            break;
+
+        // Search always completes depth 1, even at tiny node limits: the
+        // score is a real label and the move a searched one
+        chess::engine::SearchResult searched =
+            searcher.search(position, {chess::engine::MAX_PLY - 1,
+                                       options.nodes});
+        stats.merge(searcher.getStats());
+        Move best = searched.bestMove;
+
+        int white_score = us == Color::White ? searched.score : -searched.score;
+        if (std::abs(searched.score) >= MATE_ADJUDICATION) {
+            result = white_score > 0 ? Result::WhiteWin : Result::BlackWin;
+            break;
+        }
+
+        // Decisive advantage held long enough: call the game
+        if (white_score >= options.winScore)
+            winning_plies = std::max(winning_plies, 0) + 1;
+        else if (white_score <= -options.winScore)
+            winning_plies = std::min(winning_plies, 0) - 1;
+        else
+            winning_plies = 0;
+
+        if (std::abs(winning_plies) >= options.winPlies) {
+            result = winning_plies > 0 ? Result::WhiteWin : Result::BlackWin;
+            break;
+        }
+
+        bool noisy = best.isPromotion() || chess::core::isCapture(position, best);
+        if (!checked && !noisy)
+            records.push_back(chess::datagen::pack(position, white_score, ply));
+
+        position.makeMove(best);
+    }
+
+    for (PackedRecord &record : records) {
+        record.result = static_cast<std::int8_t>(result);
+        writer.write(record);
+    }
+
+    return records.size();
+}
+
+/**
+ * Play games until every game is handed out
+ *  - Errors (i.e. failed writes) are stored in progress and stop all workers,
+ *    an exception leaving a std::thread would terminate the process
+ */
+void generate_worker(const Options &options, unsigned index,
+                     chess::datagen::RecordWriter &writer,
+                     Progress &progress) {
+    // Every thread has its own random stream, searcher and output file
+    std::mt19937_64 rng(options.seed * 0x9E3779B97F4A7C15ULL + index);
+    chess::engine::Searcher searcher;
+    chess::engine::SearchStats stats;
+
+    try {
+        while (!progress.failed &&
+               progress.gamesStarted.fetch_add(1) < options.games) {
+            progress.positions +=
+                play_game(options, rng, searcher, stats, writer);
+        }
+        writer.flush();
+    } catch (const std::exception &e) {
+        std::lock_guard<std::mutex> lock(progress.mutex);
+        if (!progress.failed.exchange(true))
+            progress.error = e.what();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(progress.mutex);
+    progress.stats.merge(stats);
+}
+
+int run_generate(const Options &options) {
+    Progress progress;
+
+    // Open every output file up front so a bad path fails before any work
+    std::vector<std::unique_ptr<chess::datagen::RecordWriter>> writers;
+    for (unsigned i = 0; i < options.threads; ++i)
+        writers.push_back(std::make_unique<chess::datagen::RecordWriter>(
+            options.out + "_" + std::to_string(i) + ".bin"));
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < options.threads; ++i)
+        workers.emplace_back(generate_worker, std::cref(options), i,
+                             std::ref(*writers[i]), std::ref(progress));
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    if (progress.failed) {
+        std::cerr << "error: " << progress.error << std::endl;
+        return 1;
+    }
+
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    double per_second = seconds > 0.0 ? progress.positions / seconds : 0.0;
+
+    std::cout << "Games              : " << options.games << '\n'
+              << "Positions          : " << progress.positions << '\n'
+              << "Threads            : " << options.threads << '\n'
+              << "Time (s)           : " << seconds << '\n'
+              << "Positions/s        : " << static_cast<std::uint64_t>(per_second)
+              << '\n'
+              << "Positions/s/thread : "
+              << static_cast<std::uint64_t>(per_second / options.threads)
+              << std::endl;
+
+    if (chess::engine::STATS_ENABLED)
+        std::cout << "Stats              : " << progress.stats.toJson()
+                  << std::endl;
+
+    return 0;
+}
+
+/**
+ * Merge files and shuffle their records
+ *  - Whole data set is held in memory
+ */
+int run_shuffle(const std::string &out, const std::vector<std::string> &inputs,
+                std::uint64_t seed) {
+    std::vector<PackedRecord> records;
+    for (const std::string &input : inputs) {
+        std::vector<PackedRecord> read = chess::datagen::readRecords(input);
+        records.insert(records.end(), read.begin(), read.end());
+    }
+
+    std::mt19937_64 rng(seed);
+    std::shuffle(records.begin(), records.end(), rng);
+
+    chess::datagen::RecordWriter writer(out);
+    for (const PackedRecord &record : records)
+        writer.write(record);
+    writer.flush();
+
+    std::cout << "Shuffled " << records.size() << " records into " << out
+              << std::endl;
+    return 0;
+}
+
+// Print the first records of a file as FEN, score and result
+int run_dump(const std::string &path, std::size_t count) {
+    std::vector<PackedRecord> records = chess::datagen::readRecords(path);
+    count = std::min(count, records.size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        std::cout << chess::datagen::toFen(records[i]) << " | "
+                  << records[i].score << " | "
+                  << static_cast<int>(records[i].result) << '\n';
+    }
+    return 0;
+}
+
+int usage() {
+    std::cerr
+        << "usage:\n"
+        << "  chess_datagen generate [--threads N] [--games N] [--nodes N]\n"
+        << "                         [--random-plies N] [--max-plies N]\n"
+        << "                         [--win-score CP] [--win-plies N]\n"
+        << "                         [--seed N] [--out PREFIX]\n"
+        << "  chess_datagen shuffle OUT IN... [--seed N]\n"
+        << "  chess_datagen dump FILE [COUNT]\n";
+    return 1;
+}
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+/**
+ * Self-play training data generator
+ *  - generate: fixed node self-play games from random openings, one output
+ *    file per thread
+ *  - shuffle: merge the per thread files into one shuffled file
+ *  - dump: print records for inspection
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 2)
+        return usage();
+
+    std::string command = argv[1];
+    std::vector<std::string> args(argv + 2, argv + argc);
+
+    try {
+        if (command == "generate") {
+            Options options;
+            for (std::size_t i = 0; i < args.size(); i += 2) {
+                const std::string &flag = args[i];
+                if (i + 1 == args.size())
+                    throw UsageError("missing value for " + flag);
+                const std::string &value = args[i + 1];
+
+                if (flag == "--threads")
+                    options.threads = parse_number<unsigned>(flag, value);
+                else if (flag == "--games")
+                    options.games = parse_number<std::uint64_t>(flag, value);
+                else if (flag == "--nodes")
+                    options.nodes = parse_number<std::uint64_t>(flag, value);
+                else if (flag == "--random-plies")
+                    options.randomPlies = parse_number<int>(flag, value);
+                else if (flag == "--max-plies")
+                    options.maxPlies = parse_number<int>(flag, value);
+                else if (flag == "--win-score")
+                    options.winScore = parse_number<int>(flag, value);
+                else if (flag == "--win-plies")
+                    options.winPlies = parse_number<int>(flag, value);
+                else if (flag == "--seed")
+                    options.seed = parse_number<std::uint64_t>(flag, value);
+                else if (flag == "--out")
+                    options.out = value;
+                else
+                    throw UsageError("unknown option " + flag);
+            }
+
+            // 0 nodes means "no node limit" to the search: never finishes
+            if (options.nodes == 0)
+                throw UsageError("--nodes must be at least 1");
+            if (options.threads == 0)
+                throw UsageError("--threads must be at least 1");
+            if (options.randomPlies < 0 || options.maxPlies < 0 ||
+                options.winPlies < 1 || options.winScore < 1)
+                throw UsageError("--random-plies and --max-plies must not be "
+                                 "negative, --win-score and --win-plies "
+                                 "must be at least 1");
+
+            return run_generate(options);
+        }
+
+        if (command == "shuffle" && args.size() >= 2) {
+            std::uint64_t seed = 1;
+            std::vector<std::string> inputs;
+            for (std::size_t i = 1; i < args.size(); ++i) {
+                if (args[i] != "--seed") {
+                    inputs.push_back(args[i]);
+                    continue;
+                }
+                if (i + 1 == args.size())
+                    throw UsageError("missing value for --seed");
+                seed = parse_number<std::uint64_t>(args[i], args[i + 1]);
+                ++i;
+            }
+            if (inputs.empty())
+                throw UsageError("shuffle needs at least one input file");
+
+            return run_shuffle(args[0], inputs, seed);
+        }
+
+        if (command == "dump" && !args.empty()) {
+            std::size_t count =
+                args.size() > 1 ? parse_number<std::size_t>("COUNT", args[1])
+                                : 10;
+            return run_dump(args[0], count);
+        }
+    } catch (const UsageError &e) {
+        std::cerr << "error: " << e.what() << '\n';
+        return usage();
+    } catch (const std::exception &e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return usage();
+}
@@ -0,0 +1,66 @@
+#include "../../include/chess/engine/Evaluate.hpp"
+#include "../../include/chess/core/Bitboard.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace chess::engine {
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+// 0 on the edge of the board, 3 on the four center squares
+constexpr int centrality(int square) {
+    int rank = core::rankOf(square);
+    int file = core::fileOf(square);
+    int rank_dist = std::max(3 - rank, rank - 4);
+    int file_dist = std::max(3 - file, file - 4);
+    return 3 - std::max(rank_dist, file_dist);
+}
+
+int evaluate_side(const core::Position &position, core::Color color) {
+    using core::PieceType;
+
+    int score = 0;
+    for (int piece = 0; piece < static_cast<int>(PieceType::Count); ++piece) {
+        PieceType type = static_cast<PieceType>(piece);
+        std::uint64_t bit_board = position.getPieces(color, type);
+
+        while (bit_board) {
+            int square = __builtin_ctzll(bit_board);
+            bit_board &= bit_board - 1;
+
+            score += pieceValue(type);
+
+            switch (type) {
+            case PieceType::Knight:
+            case PieceType::Bishop:
+                score += 8 * centrality(square);
+                break;
+            case PieceType::Pawn: {
+                // Ranks advanced from the pawn's starting rank
+                int advanced = color == core::Color::White
+                                   ? core::rankOf(square) - 1
+                                   : 6 - core::rankOf(square);
+                score += 4 * advanced + 4 * centrality(square);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    return score;
+}
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+int evaluate(const core::Position &position) {
+    core::Color us = position.sideToMove();
+    return evaluate_side(position, us) -
+           evaluate_side(position, core::opposite(us));
+}
+
+} // namespace chess::engine
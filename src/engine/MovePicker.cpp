@@ -0,0 +1,245 @@
+#include "../../include/chess/engine/MovePicker.hpp"
+#include "../../include/chess/core/MoveGen.hpp"
+#include "../../include/chess/engine/Evaluate.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+namespace chess::engine {
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+// Evasion captures are searched before every quiet evasion
+constexpr int EVASION_CAPTURE_BONUS = 1 << 20;
+
+// Most valuable victim / least valuable attacker, promotions on top
+int capture_score(const core::Position &position, const core::Move &move) {
+    int score = 0;
+
+    core::Color color;
+    core::PieceType victim;
+    core::PieceType attacker;
+    if (core::isCapture(position, move) &&
+        position.findPieceAt(move.to, color, victim) &&
+        position.findPieceAt(move.from, color, attacker))
+        score += 10 * pieceValue(victim) - pieceValue(attacker);
+
+    if (move.isPromotion())
+        score += pieceValue(move.promotion);
+
+    return score;
+}
+
+/**
+ * Cheap stand-in for static exchange evaluation
+ *  - A capture is bad when a more valuable piece takes a less valuable one
+ *    on a square the opponent defends
+ */
+bool is_bad_capture(const core::Position &position, const core::Move &move) {
+    if (move.isPromotion())
+        return false;
+
+    core::Color color;
+    core::PieceType victim;
+    core::PieceType attacker;
+    if (!position.findPieceAt(move.to, color, victim) ||
+        !position.findPieceAt(move.from, color, attacker))
+        return false;
+
+    return pieceValue(attacker) > pieceValue(victim) &&
+           core::isSquareAttacked(position, move.to,
+                                  core::opposite(position.sideToMove()));
+}
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+/* ========= HISTORY ========= */
+void HistoryTable::update(core::Color color, const core::Move &move,
+                          int bonus) {
+    int &entry = table[static_cast<std::size_t>(color)][move.from][move.to];
+
+    // Gravity: entry moves towards MAX, the closer it is the smaller the step
+    bonus = std::clamp(bonus, -MAX, MAX);
+    entry += bonus - entry * std::abs(bonus) / MAX;
+}
+
+/* ========= CONSTRUCTORS ========= */
+MovePicker::MovePicker(const core::Position &position,
+                       const core::Move &ttMove,
+                       const std::array<core::Move, 2> &killers,
+                       const HistoryTable &history)
+    : position(position), history(&history), ttMove(ttMove),
+      killers(killers), stage(Stage::TTMove) {}
+
+MovePicker::MovePicker(const core::Position &position)
+    : position(position), stage(Stage::QGenerateCaptures) {}
+
+/* ========= PICKING ========= */
+core::Move MovePicker::next() {
+    for (;;) {
+        switch (stage) {
+        case Stage::TTMove: {
+            bool checked = core::inCheck(position, position.sideToMove());
+            stage = checked ? Stage::GenerateEvasions : Stage::GenerateCaptures;
+
+            if (core::isPseudoLegal(position, ttMove))
+                return ttMove;
+
+            ttMove = {};
+            break;
+        }
+
+        case Stage::GenerateCaptures:
+        case Stage::QGenerateCaptures:
+            core::generate<core::GenType::Captures>(position, moves);
+            end = moves.size();
+            generatedCount += end;
+            scoreCaptures();
+
+            stage = stage == Stage::GenerateCaptures ? Stage::GoodCaptures
+                                                     : Stage::QCaptures;
+            break;
+
+        case Stage::GoodCaptures:
+            while (current < end) {
+                core::Move move = pickBest();
+                if (isSpecial(move))
+                    continue;
+
+                // Delay losing captures until quiets are searched.
+                // badEnd < current: the slot was already handed out
+                if (is_bad_capture(position, move)) {
+                    moves[badEnd++] = move;
+                    continue;
+                }
+                return move;
+            }
+            stage = Stage::FirstKiller;
+            break;
+
+        case Stage::FirstKiller:
+        case Stage::SecondKiller: {
+            bool first = stage == Stage::FirstKiller;
+            stage = first ? Stage::SecondKiller : Stage::GenerateQuiets;
+
+            const core::Move &killer = killers[first ? 0 : 1];
+            if (!first && killer == killers[0])
+                break;
+
+            if (!killer.isNull() && killer != ttMove &&
+                !killer.isPromotion() && !core::isCapture(position, killer) &&
+                core::isPseudoLegal(position, killer))
+                return killer;
+            break;
+        }
+
+        case Stage::GenerateQuiets:
+            // Appended after the captures, [current, end) is only quiets now
+            core::generate<core::GenType::Quiets>(position, moves);
+            generatedCount += moves.size() - end;
+            current = end;
+            end = moves.size();
+            scoreQuiets();
+
+            stage = Stage::Quiets;
+            break;
+
+        case Stage::Quiets:
+            while (current < end) {
+                core::Move move = pickBest();
+                if (!isSpecial(move))
+                    return move;
+            }
+            stage = Stage::BadCaptures;
+            break;
+
+        case Stage::BadCaptures:
+            if (badCurrent < badEnd)
+                return moves[badCurrent++];
+
+            stage = Stage::Done;
+            break;
+
+        case Stage::GenerateEvasions:
+            core::generate<core::GenType::Evasions>(position, moves);
+            end = moves.size();
+            generatedCount += end;
+            scoreEvasions();
+
+            stage = Stage::Evasions;
+            break;
+
+        case Stage::Evasions:
+        case Stage::QCaptures:
+            while (current < end) {
+                core::Move move = pickBest();
+                if (!isSpecial(move))
+                    return move;
+            }
+            stage = Stage::Done;
+            break;
+
+        case Stage::Done:
+            return {};
+        }
+    }
+}
+
+bool MovePicker::isSpecial(const core::Move &move) const {
+    if (move == ttMove)
+        return true;
+
+    // Killers were only handed out in the quiet part of the main search
+    return stage == Stage::Quiets &&
+           (move == killers[0] || move == killers[1]);
+}
+
+/* ========= SCORING ========= */
+void MovePicker::scoreCaptures() {
+    for (std::size_t i = current; i < end; ++i)
+        scores[i] = capture_score(position, moves[i]);
+}
+
+void MovePicker::scoreQuiets() {
+    core::Color us = position.sideToMove();
+    for (std::size_t i = current; i < end; ++i)
+        scores[i] = history->get(us, moves[i]);
+}
+
+void MovePicker::scoreEvasions() {
+    core::Color us = position.sideToMove();
+    for (std::size_t i = current; i < end; ++i) {
+        if (core::isCapture(position, moves[i]) || moves[i].isPromotion())
+            scores[i] =
+                EVASION_CAPTURE_BONUS + capture_score(position, moves[i]);
+        else
+            scores[i] = history->get(us, moves[i]);
+    }
+}
+
+core::Move MovePicker::pickBest() {
+    // Ties are broken by the squares of the move so the order (and thus the
+    // bench signature) does not depend on the order moves were generated in
+    std::size_t best = current;
+    for (std::size_t i = current + 1; i < end; ++i) {
+        const core::Move &a = moves[i];
+        const core::Move &b = moves[best];
+        if (scores[i] != scores[best]) {
+            if (scores[i] > scores[best])
+                best = i;
+        } else if (a.from != b.from ? a.from < b.from
+                   : a.to != b.to   ? a.to < b.to
+                                    : a.promotion < b.promotion) {
+            best = i;
+        }
+    }
+
+    std::swap(moves[best], moves[current]);
+    std::swap(scores[best], scores[current]);
+    return moves[current++];
+}
+
+} // namespace chess::engine
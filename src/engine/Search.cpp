@@ -0,0 +1,210 @@
+#include "../../include/chess/engine/Search.hpp"
+#include "../../include/chess/core/MoveGen.hpp"
+#include "../../include/chess/engine/Evaluate.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+namespace chess::engine {
+
+bool parseDepth(const std::string &text, int &depth) {
+    int parsed = 0;
+    const char *end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, parsed);
+
+    if (ec != std::errc() || ptr != end || parsed < 1 || parsed >= MAX_PLY)
+        return false;
+
+    depth = parsed;
+    return true;
+}
+
+
+SearchResult Searcher::search(const core::Position &position,
+                              const SearchLimits &limits) {
+    nodes = 0;
+    nodeLimit = 0; // Depth 1 always completes, see below
+    stopped = false;
+    searchStats.reset();
+    killers = {};
+    history.clear();
+
+    SearchResult result;
+
+    // --- Iterative deepening
+    for (int depth = 1; depth <= std::max(limits.depth, 1); ++depth) {
+        previousBestMove = result.bestMove;
+        rootBestMove = {};
+        int score =
+            negamax(position, depth, -INFINITE_SCORE, INFINITE_SCORE, 0);
+
+        // Partial iterations are thrown away
+        if (stopped)
+            break;
+
+        result.bestMove = rootBestMove;
+        result.score = score;
+        result.depth = depth;
+
+        // Depth 1 is cheap (quiescence below each root move) and gives a real
+        // move and score, the node limit counts from the start of the search
+        nodeLimit = limits.nodes;
+        if (nodeLimit && nodes >= nodeLimit)
+            break;
+    }
+
+    result.nodes = nodes;
+    return result;
+}
+
+bool Searcher::visitNode() {
+    ++nodes;
+    if (nodeLimit && nodes >= nodeLimit)
+        stopped = true;
+
+    return !stopped;
+}
+
+int Searcher::negamax(const core::Position &position, int depth, int alpha,
+                      int beta, int ply) {
+    if (depth <= 0)
+        return quiescence(position, alpha, beta, ply);
+
+    if (!visitNode())
+        return 0;
+    CHESS_STAT_INC(searchStats, nodes);
+
+    if (ply >= MAX_PLY)
+        return evaluate(position);
+
+    core::Color us = position.sideToMove();
+
+    // No transposition table yet: only the root has a move to try first
+    MovePicker picker(position, ply == 0 ? previousBestMove : core::Move{},
+                      killers[ply], history);
+
+    int best = -INFINITE_SCORE;
+    int legal = 0;
+    for (;;) {
+        core::Move move;
+        {
+            CHESS_STAT_TIMER(searchStats, Phase::MovePicking);
+            move = picker.next();
+        }
+        if (move.isNull())
+            break;
+
+        // Copy-make: position is a few bitboards, cheaper than an undo stack
+        core::Position child = position;
+        child.makeMove(move);
+
+        // Pseudo-legal move left own king in check
+        if (core::inCheck(child, us)) {
+            CHESS_STAT_INC(searchStats, illegalMoves);
+            continue;
+        }
+        ++legal;
+
+        int score = -negamax(child, depth - 1, -beta, -alpha, ply + 1);
+        if (stopped)
+            return 0;
+
+        if (score > best) {
+            best = score;
+            if (ply == 0)
+                rootBestMove = move;
+        }
+
+        if (score > alpha)
+            alpha = score;
+
+        if (alpha >= beta) {
+            CHESS_STAT_INC(searchStats, betaCutoffs);
+            if (legal == 1)
+                CHESS_STAT_INC(searchStats, firstMoveCutoffs);
+
+            if (!move.isPromotion() && !core::isCapture(position, move))
+                updateQuietCutoff(us, move, depth, ply);
+            break;
+        }
+    }
+
+    CHESS_STAT_ADD(searchStats, movesGenerated, picker.generated());
+
+    // No legal moves: checkmate or stalemate
+    if (legal == 0)
+        return core::inCheck(position, us) ? -MATE_SCORE + ply : 0;
+
+    return best;
+}
+
+int Searcher::quiescence(const core::Position &position, int alpha, int beta,
+                         int ply) {
+    if (!visitNode())
+        return 0;
+    CHESS_STAT_INC(searchStats, qnodes);
+
+    // Stand pat: side to move can usually do at least as well as static eval
+    int best;
+    {
+        CHESS_STAT_TIMER(searchStats, Phase::Evaluate);
+        best = evaluate(position);
+    }
+    if (best >= beta || ply >= MAX_PLY)
+        return best;
+
+    if (best > alpha)
+        alpha = best;
+
+    core::Color us = position.sideToMove();
+
+    // Only noisy moves: captures and promotions
+    MovePicker picker(position);
+
+    for (;;) {
+        core::Move move;
+        {
+            CHESS_STAT_TIMER(searchStats, Phase::MovePicking);
+            move = picker.next();
+        }
+        if (move.isNull())
+            break;
+
+        core::Position child = position;
+        child.makeMove(move);
+
+        if (core::inCheck(child, us)) {
+            CHESS_STAT_INC(searchStats, illegalMoves);
+            continue;
+        }
+
+        int score = -quiescence(child, -beta, -alpha, ply + 1);
+        if (stopped)
+            return 0;
+
+        if (score > best)
+            best = score;
+
+        if (score > alpha)
+            alpha = score;
+
+        if (alpha >= beta)
+            break;
+    }
+
+    CHESS_STAT_ADD(searchStats, movesGenerated, picker.generated());
+
+    return best;
+}
+
+void Searcher::updateQuietCutoff(core::Color us, const core::Move &move,
+                                 int depth, int ply) {
+    if (killers[ply][0] != move) {
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+
+    history.update(us, move, depth * depth);
+}
+
+} // namespace chess::engine
@@ -0,0 +1,59 @@
+#include "../../include/chess/engine/Stats.hpp"
+
+#include <sstream>
+
+namespace chess::engine {
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+constexpr const char *PHASE_NAMES[] = {"move_picking", "evaluate"};
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+void SearchStats::merge(const SearchStats &other) {
+    nodes += other.nodes;
+    qnodes += other.qnodes;
+    betaCutoffs += other.betaCutoffs;
+    firstMoveCutoffs += other.firstMoveCutoffs;
+    illegalMoves += other.illegalMoves;
+    movesGenerated += other.movesGenerated;
+
+    for (std::size_t i = 0; i < phaseNanos.size(); ++i)
+        phaseNanos[i] += other.phaseNanos[i];
+}
+
+double SearchStats::firstMoveCutoffRate() const {
+    return betaCutoffs ? static_cast<double>(firstMoveCutoffs) / betaCutoffs
+                       : 0.0;
+}
+
+std::string SearchStats::toJson() const {
+    std::ostringstream json;
+
+    json << "{\"enabled\":" << (STATS_ENABLED ? "true" : "false");
+
+    if (STATS_ENABLED) {
+        json << ",\"nodes\":" << nodes << ",\"qnodes\":" << qnodes
+             << ",\"beta_cutoffs\":" << betaCutoffs
+             << ",\"first_move_cutoffs\":" << firstMoveCutoffs
+             << ",\"first_move_cutoff_rate\":" << firstMoveCutoffRate()
+             << ",\"illegal_moves\":" << illegalMoves
+             << ",\"moves_generated\":" << movesGenerated;
+    }
+
+    if (STATS_TIMERS_ENABLED) {
+        json << ",\"phase_ns\":{";
+        for (std::size_t i = 0; i < phaseNanos.size(); ++i) {
+            json << (i ? "," : "") << '"' << PHASE_NAMES[i]
+                 << "\":" << phaseNanos[i];
+        }
+        json << '}';
+    }
+
+    json << '}';
+    return json.str();
+}
+
+} // namespace chess::engine
@@ -4,11 +4,27 @@
 #include <SFML/Window/VideoMode.hpp>
 
 #include "../include/chess/core/Position.hpp"
+#include "../include/chess/engine/Bench.hpp"
+#include "../include/chess/engine/Search.hpp"
 #include "../include/chess/ui/board_view.hpp"
 #include "../include/chess/ui/input_controller.hpp"
 #include <iostream>
+#include <string>
 
-int main() {
+int main(int argc, char *argv[]) {
+
+    // ------ Headless bench: chess --bench [depth] ------
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        int depth = chess::engine::DEFAULT_BENCH_DEPTH;
+        if (argc > 2 && !chess::engine::parseDepth(argv[2], depth)) {
+            std::cerr << "usage: chess --bench [depth 1-"
+                      << chess::engine::MAX_PLY - 1 << ']' << std::endl;
+            return 1;
+        }
+
+        chess::engine::runBench(depth, std::cout);
+        return 0;
+    }
 
     std::cout << "Humble beginnings..." << std::endl;
 
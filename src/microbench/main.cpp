@@ -0,0 +1,239 @@
+#include "../../include/chess/core/Bitboard.hpp"
+#include "../../include/chess/core/Move.hpp"
+#include "../../include/chess/core/MoveGen.hpp"
+#include "../../include/chess/core/Position.hpp"
+#include "../../include/chess/engine/Bench.hpp"
+#include "../../include/chess/engine/MovePicker.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * Micro benchmarks for core primitives
+ *  - Machine readable output:
+ *    chess_microbench --benchmark_out=micro.json --benchmark_out_format=json
+ */
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+using namespace chess::core;
+
+const std::string START_FEN =
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+const std::string MIDDLEGAME_FEN =
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 10";
+
+// Bitboards with few / many bits set
+const std::vector<Bitboard> BITBOARDS = {
+    0x000000000000FF00ULL, 0x00FF00000000FF00ULL, 0x8100000000000081ULL,
+    0x0000001818000000ULL, 0xFFFF00000000FFFFULL, 0x2040810204081ULL,
+    0x5555555555555555ULL, 0x0000000000000001ULL,
+};
+
+/* ========= POSITION ========= */
+void BM_PositionFromFen(benchmark::State &state, const std::string &fen) {
+    for (auto _ : state) {
+        Position position(fen);
+        benchmark::DoNotOptimize(position);
+    }
+}
+BENCHMARK_CAPTURE(BM_PositionFromFen, startpos, START_FEN);
+BENCHMARK_CAPTURE(BM_PositionFromFen, middlegame, MIDDLEGAME_FEN);
+
+void BM_GetAllPieces(benchmark::State &state) {
+    Position position(MIDDLEGAME_FEN);
+    for (auto _ : state) {
+        std::vector<PieceOnSquare> pieces = position.getAllPieces();
+        benchmark::DoNotOptimize(pieces.data());
+    }
+}
+BENCHMARK(BM_GetAllPieces);
+
+// One iteration = lookup on all 64 squares
+void BM_FindPieceAt(benchmark::State &state) {
+    Position position(MIDDLEGAME_FEN);
+    for (auto _ : state) {
+        for (int square = 0; square < 64; ++square) {
+            Color color;
+            PieceType piece;
+            bool found = position.findPieceAt(square, color, piece);
+            benchmark::DoNotOptimize(found);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_FindPieceAt);
+
+// Copy-make as done by search: copy position, then play one move
+void BM_MakeMove(benchmark::State &state) {
+    Position position(MIDDLEGAME_FEN);
+
+    // Squares refer to documents/board_setup.md
+    const Move quiet{35, 29};   // Ne5-c4
+    const Move capture{35, 50}; // Ne5xf7
+    for (auto _ : state) {
+        Position quiet_child = position;
+        quiet_child.makeMove(quiet);
+        benchmark::DoNotOptimize(quiet_child);
+
+        Position capture_child = position;
+        capture_child.makeMove(capture);
+        benchmark::DoNotOptimize(capture_child);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_MakeMove);
+
+/* ========= MOVE GENERATION ========= */
+// One iteration = generate for every bench position
+std::vector<Position> bench_positions() {
+    std::vector<Position> positions;
+    for (const std::string &fen : chess::engine::benchPositions())
+        positions.emplace_back(fen);
+    return positions;
+}
+
+void BM_GenerateRuntime(benchmark::State &state) {
+    std::vector<Position> positions = bench_positions();
+    std::int64_t generated = 0;
+    for (auto _ : state) {
+        for (const Position &position : positions) {
+            MoveList moves;
+            generateMoves(position, moves);
+            benchmark::DoNotOptimize(moves.begin());
+            generated += moves.size();
+        }
+    }
+    state.SetItemsProcessed(generated);
+}
+BENCHMARK(BM_GenerateRuntime);
+
+template <GenType Type> void BM_GenerateSpecialised(benchmark::State &state) {
+    std::vector<Position> positions = bench_positions();
+    std::int64_t generated = 0;
+    for (auto _ : state) {
+        for (const Position &position : positions) {
+            MoveList moves;
+            generate<Type>(position, moves);
+            benchmark::DoNotOptimize(moves.begin());
+            generated += moves.size();
+        }
+    }
+    state.SetItemsProcessed(generated);
+}
+BENCHMARK(BM_GenerateSpecialised<GenType::All>);
+BENCHMARK(BM_GenerateSpecialised<GenType::Captures>);
+BENCHMARK(BM_GenerateSpecialised<GenType::Quiets>);
+
+// One iteration = check test for both kings of every bench position
+void BM_InCheck(benchmark::State &state) {
+    std::vector<Position> positions = bench_positions();
+    for (auto _ : state) {
+        for (const Position &position : positions) {
+            benchmark::DoNotOptimize(inCheck(position, Color::White));
+            benchmark::DoNotOptimize(inCheck(position, Color::Black));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size() * 2);
+}
+BENCHMARK(BM_InCheck);
+
+/* ========= MOVE PICKER ========= */
+/**
+ * Moves handed out before a cut node fails high
+ *  - range(0): number of moves taken from the picker (1 = first move cutoff)
+ *  - range(1): 1 = first generated move is given as TT move
+ *  - moves_generated: moves generated per node, compare with moves_per_node
+ *    of a full generation
+ */
+void BM_MovePicker(benchmark::State &state) {
+    std::vector<Position> positions = bench_positions();
+    const std::size_t taken = static_cast<std::size_t>(state.range(0));
+    const bool use_tt = state.range(1) != 0;
+
+    std::vector<Move> tt_moves;
+    for (const Position &position : positions) {
+        MoveList moves;
+        generate<GenType::All>(position, moves);
+        tt_moves.push_back(use_tt && !moves.empty() ? moves[0] : Move{});
+    }
+
+    const chess::engine::HistoryTable history;
+    const std::array<Move, 2> killers{};
+    std::int64_t generated = 0;
+    std::int64_t full = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            chess::engine::MovePicker picker(positions[i], tt_moves[i],
+                                             killers, history);
+            for (std::size_t n = 0; n < taken; ++n) {
+                Move move = picker.next();
+                benchmark::DoNotOptimize(move);
+                if (move.isNull())
+                    break;
+            }
+            generated += picker.generated();
+        }
+    }
+
+    for (const Position &position : positions) {
+        MoveList moves;
+        generate<GenType::All>(position, moves);
+        full += moves.size();
+    }
+
+    double nodes = static_cast<double>(state.iterations()) * positions.size();
+    state.counters["moves_generated"] = generated / nodes;
+    state.counters["moves_per_node"] =
+        static_cast<double>(full) / positions.size();
+}
+BENCHMARK(BM_MovePicker)
+    ->ArgNames({"taken", "tt"})
+    ->Args({1, 1})
+    ->Args({1, 0})
+    ->Args({256, 0});
+
+/* ========= BITBOARD UTILITIES ========= */
+void BM_PopCount(benchmark::State &state) {
+    for (auto _ : state) {
+        for (Bitboard bb : BITBOARDS)
+            benchmark::DoNotOptimize(popCount(bb));
+    }
+    state.SetItemsProcessed(state.iterations() * BITBOARDS.size());
+}
+BENCHMARK(BM_PopCount);
+
+void BM_BitScan(benchmark::State &state) {
+    for (auto _ : state) {
+        for (Bitboard bb : BITBOARDS) {
+            benchmark::DoNotOptimize(lsb(bb));
+            benchmark::DoNotOptimize(msb(bb));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BITBOARDS.size() * 2);
+}
+BENCHMARK(BM_BitScan);
+
+// Visit every set square of every bitboard
+void BM_SquareIteration(benchmark::State &state) {
+    std::int64_t squares = 0;
+    for (auto _ : state) {
+        for (Bitboard bb : BITBOARDS) {
+            while (bb) {
+                int square = popLsb(bb);
+                benchmark::DoNotOptimize(square);
+                ++squares;
+            }
+        }
+    }
+    state.SetItemsProcessed(squares);
+}
+BENCHMARK(BM_SquareIteration);
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+BENCHMARK_MAIN();
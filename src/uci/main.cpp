@@ -0,0 +1,192 @@
+#include "../../include/chess/core/Bitboard.hpp"
+#include "../../include/chess/core/MoveGen.hpp"
+#include "../../include/chess/core/Position.hpp"
+#include "../../include/chess/engine/Bench.hpp"
+#include "../../include/chess/engine/Search.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+namespace {
+
+using chess::core::Move;
+using chess::core::PieceType;
+using chess::core::Position;
+
+const std::string START_FEN =
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// Square index -> "e4", refer to documents/board_setup.md
+std::string square_name(int square) {
+    std::string name;
+    name += static_cast<char>('a' + chess::core::fileOf(square));
+    name += static_cast<char>('1' + chess::core::rankOf(square));
+    return name;
+}
+
+std::string move_to_uci(const Move &move) {
+    if (move.isNull())
+        return "0000";
+
+    std::string uci = square_name(move.from) + square_name(move.to);
+    switch (move.promotion) {
+    case PieceType::Queen:
+        uci += 'q';
+        break;
+    case PieceType::Rook:
+        uci += 'r';
+        break;
+    case PieceType::Bishop:
+        uci += 'b';
+        break;
+    case PieceType::Knight:
+        uci += 'n';
+        break;
+    default:
+        break;
+    }
+
+    return uci;
+}
+
+// Find the generated move matching the uci string (null move if none)
+Move parse_move(const Position &position, const std::string &uci) {
+    chess::core::MoveList moves;
+    chess::core::generate<chess::core::GenType::All>(position, moves);
+
+    for (const Move &move : moves) {
+        if (move_to_uci(move) == uci)
+            return move;
+    }
+
+    return {};
+}
+
+// position [startpos | fen <fen>] [moves <m1> <m2> ...]
+void handle_position(std::istringstream &iss, Position &position) {
+    std::string token;
+    iss >> token;
+
+    std::string fen;
+    if (token == "startpos") {
+        fen = START_FEN;
+        iss >> token; // "moves" if present
+    } else if (token == "fen") {
+        while (iss >> token && token != "moves")
+            fen += token + ' ';
+    } else {
+        return;
+    }
+
+    position = Position(fen);
+
+    while (iss >> token) {
+        Move move = parse_move(position, token);
+        if (move.isNull())
+            break;
+        position.makeMove(move);
+    }
+}
+
+// Node limit typed by the user, false if text is not a whole number
+bool parse_nodes(const std::string &text, std::uint64_t &nodes) {
+    std::uint64_t parsed = 0;
+    const char *end = text.data() + text.size();
+    auto [ptr, ec] = std::from_chars(text.data(), end, parsed);
+    if (ec != std::errc() || ptr != end)
+        return false;
+
+    nodes = parsed;
+    return true;
+}
+
+// go [depth <d>] [nodes <n>]
+void handle_go(std::istringstream &iss, const Position &position) {
+    chess::engine::SearchLimits limits{chess::engine::DEFAULT_BENCH_DEPTH, 0};
+
+    // Invalid values are reported and ignored: go always answers a bestmove
+    std::string token;
+    std::string value;
+    while (iss >> token) {
+        if (token == "depth" && iss >> value &&
+            !chess::engine::parseDepth(value, limits.depth))
+            std::cout << "info string invalid depth " << value << std::endl;
+        else if (token == "nodes" && iss >> value &&
+                 !parse_nodes(value, limits.nodes))
+            std::cout << "info string invalid nodes " << value << std::endl;
+    }
+
+    chess::engine::Searcher searcher;
+    chess::engine::SearchResult result = searcher.search(position, limits);
+
+    if (chess::engine::STATS_ENABLED)
+        std::cout << "info string stats " << searcher.getStats().toJson()
+                  << std::endl;
+
+    std::cout << "info depth " << result.depth << " score cp " << result.score
+              << " nodes " << result.nodes << '\n'
+              << "bestmove " << move_to_uci(result.bestMove) << std::endl;
+}
+
+int run_bench(int argc, char *argv[]) {
+    int depth = chess::engine::DEFAULT_BENCH_DEPTH;
+    if (argc > 2 && !chess::engine::parseDepth(argv[2], depth)) {
+        std::cerr << "usage: chess_uci bench [depth 1-"
+                  << chess::engine::MAX_PLY - 1 << ']' << std::endl;
+        return 1;
+    }
+
+    chess::engine::runBench(depth, std::cout);
+    return 0;
+}
+
+} // namespace
+/* ======================= ANONYMOUS NAMESPACE ======================= */
+
+/**
+ * Console front-end speaking a subset of UCI
+ *  - chess_uci bench [depth] -> run the bench and exit
+ *  - otherwise read UCI commands from stdin
+ */
+int main(int argc, char *argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "bench")
+        return run_bench(argc, argv);
+
+    Position position(START_FEN);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream iss(line);
+        std::string command;
+        iss >> command;
+
+        if (command == "uci") {
+            std::cout << "id name chess\n"
+                      << "uciok" << std::endl;
+        } else if (command == "isready") {
+            std::cout << "readyok" << std::endl;
+        } else if (command == "ucinewgame") {
+            position = Position(START_FEN);
+        } else if (command == "position") {
+            handle_position(iss, position);
+        } else if (command == "go") {
+            handle_go(iss, position);
+        } else if (command == "bench") {
+            int depth = chess::engine::DEFAULT_BENCH_DEPTH;
+            std::string token;
+            if (iss >> token && !chess::engine::parseDepth(token, depth))
+                std::cout << "info string invalid bench depth " << token
+                          << std::endl;
+            else
+                chess::engine::runBench(depth, std::cout);
+        } else if (command == "quit") {
+            break;
+        }
+    }
+
+    return 0;
+}